@@ -243,8 +243,29 @@ bool OH_Pasteboard_HasData(OH_Pasteboard* pasteboard);
  */
 OH_UdmfData* OH_Pasteboard_GetData(OH_Pasteboard* pasteboard, int* status);
 
+/**
+ * @brief Obtains data from the Pasteboard, transferring the payload of each type only when it is read.
+ *
+ * The returned {@link OH_UdmfData} contains all records with their types, so {@link OH_UdmfData_GetTypes},
+ * {@link OH_UdmfData_HasType} and {@link OH_UdmfRecord_GetTypes} can be used right away. The payload of a type
+ * is transferred the first time it is read from a record, for example by {@link OH_UdmfRecord_GetPlainText},
+ * in the same way as the data of a record set by {@link OH_UdmfRecord_SetProvider} is obtained.
+ * If the Pasteboard content changes before a payload is read, reading it fails with {@link UDMF_ERR}.
+ *
+ * @param pasteboard Pointer to the {@link OH_Pasteboard} instance.
+ * @param types Pointer to the types whose payloads are transferred immediately. It can be nullptr.
+ * @param count Number of types.
+ * @param status The status code of the execution. For details, see {@link PASTEBOARD_ErrCode}.
+ * @return Returns the pointer to the {@link OH_UdmfData} instance.
+ * @see OH_Pasteboard OH_UdmfData PASTEBOARD_ErrCode.
+ * @since 14
+ */
+OH_UdmfData* OH_Pasteboard_GetDataLazily(OH_Pasteboard* pasteboard, const char* const* types, unsigned int count,
+    int* status);
+
 /**
  * @brief Writes data to the Pasteboard.
+ * Array buffers set by {@link OH_UdsArrayBuffer_SetSharedMemory} are passed by file descriptor without copying.
  *
  * @param pasteboard Pointer to the {@link OH_Pasteboard} instance.
  * @param data Pointer to the {@link OH_UdmfData} instance.
@@ -67,6 +67,15 @@ typedef struct OH_Preferences OH_Preferences;
  */
 typedef void (*OH_PreferencesDataObserver)(void *context, const OH_PreferencesPair *pairs, uint32_t count);
 
+/**
+ * @brief Call to return the result of an asynchronous flush.
+ *
+ * @param context Pointer to the context passed to {@Link OH_Preferences_FlushAsync}.
+ * @param errCode The status code of the flush. For details, See {@link OH_Preferences_ErrCode}.
+ * @since 14
+ */
+typedef void (*OH_PreferencesFlushCallback)(void *context, int errCode);
+
 /**
  * @brief Opens a Preferences object.
  *
@@ -85,8 +94,23 @@ typedef void (*OH_PreferencesDataObserver)(void *context, const OH_PreferencesPa
  */
 OH_Preferences *OH_Preferences_Open(OH_PreferencesOption *option, int *errCode);
 
+/**
+ * @brief Checks whether a storage type is supported on the current platform.
+ *
+ * @param type The {@Link Preferences_StorageType} to check.
+ * @param isSupported Pointer to the result, true is written to it if the storage type is supported.
+ * @return Returns the status code of the execution.
+ *         {@link PREFERENCES_OK} indicates the operation is successful.
+ *         {@link PREFERENCES_ERROR_INVALID_PARAM} indicates invalid args are passed in.
+ * @see Preferences_StorageType.
+ * @since 14
+ */
+int OH_Preferences_IsStorageTypeSupported(Preferences_StorageType type, bool *isSupported);
+
 /**
  * @brief Closes a Preferences object.
+ * Modifications that are not persisted yet are flushed before the object is closed, and the callbacks of
+ * {@Link OH_Preferences_FlushAsync} that are still pending are called before this function returns.
  *
  * @param preference Pointer to the {@Link OH_Preferences} instance to close.
  * @param option Pointer to an {@Link OH_PreferencesOption} instance.
@@ -210,6 +234,58 @@ int OH_Preferences_SetBool(OH_Preferences *preference, const char *key, bool val
  */
 int OH_Preferences_SetString(OH_Preferences *preference, const char *key, const char *value);
 
+/**
+ * @brief Obtains a snapshot of all KV pairs in a Preferences object.
+ * The snapshot is taken under one lock acquisition and is allocated as one block.
+ * Its string values can be read without copying by {@Link OH_PreferencesValue_GetStringView}.
+ *
+ * @param preference Pointer to the target {@Link OH_Preferences} instance.
+ * @param pairs Double pointer to the KV pairs obtained, which are read by {@Link OH_PreferencesPair_GetKey} and
+ * {@Link OH_PreferencesPair_GetPreferencesValue}. Release {@Link OH_Preferences_FreePairs} the memory by user
+ * when this parameter is no longer required.
+ * @param count Pointer to the number of KV pairs obtained.
+ * @return Returns the status code of the execution.
+ *         {@link PREFERENCES_OK} indicates the operation is successful.
+ *         {@link PREFERENCES_ERROR_INVALID_PARAM} indicates invalid args are passed in.
+ *         {@link PREFERENCES_ERROR_STORAGE} indicates an storage error.
+ *         {@link PREFERENCES_ERROR_MALLOC} indicates an malloc memory error.
+ * @see OH_Preferences OH_PreferencesPair.
+ * @since 14
+ */
+int OH_Preferences_GetAll(OH_Preferences *preference, OH_PreferencesPair **pairs, uint32_t *count);
+
+/**
+ * @brief Free the KV pairs got by {@Link OH_Preferences_GetAll}.
+ *
+ * @param pairs Point to the KV pairs need to free.
+ * @see OH_Preferences.
+ * @since 14
+ */
+void OH_Preferences_FreePairs(OH_PreferencesPair *pairs);
+
+/**
+ * @brief Sets multiple KV pairs in a Preferences object under one lock acquisition.
+ * A value of type PREFERENCE_TYPE_NULL deletes the key.
+ * The batch is all-or-nothing. All keys and values are checked before any of them is applied, and if one is
+ * invalid, nothing is changed. In PREFERENCES_FLUSH_SYNC mode the whole batch is persisted in one write,
+ * and if that write fails, the changes are rolled back in memory as well. Observers are notified once for all
+ * changed keys, after the batch has been applied, and are not notified if the batch fails.
+ *
+ * @param preference Pointer to the target {@Link OH_Preferences} instance.
+ * @param keys Pointer to the keys to set.
+ * @param values Pointer to the values to set, one per key.
+ * @param count Number of keys.
+ * @return Returns the status code of the execution.
+ *         {@link PREFERENCES_OK} indicates the operation is successful.
+ *         {@link PREFERENCES_ERROR_INVALID_PARAM} indicates invalid args are passed in.
+ *         {@link PREFERENCES_ERROR_STORAGE} indicates an storage error.
+ *         {@link PREFERENCES_ERROR_MALLOC} indicates an malloc memory error.
+ * @see OH_Preferences OH_PreferencesValue.
+ * @since 14
+ */
+int OH_Preferences_SetBatch(OH_Preferences *preference, const char *const *keys, OH_PreferencesValue *const *values,
+    uint32_t count);
+
 /**
  * @brief Deletes a KV pair from a Preferences object.
  *
@@ -225,6 +301,39 @@ int OH_Preferences_SetString(OH_Preferences *preference, const char *key, const
  */
 int OH_Preferences_Delete(OH_Preferences *preference, const char *key);
 
+/**
+ * @brief Persists all modifications of a Preferences object and waits until they are written.
+ * The data is written to a temporary file that atomically replaces the preferences file.
+ *
+ * @param preference Pointer to the target {@Link OH_Preferences} instance.
+ * @return Returns the status code of the execution.
+ *         {@link PREFERENCES_OK} indicates the operation is successful.
+ *         {@link PREFERENCES_ERROR_INVALID_PARAM} indicates invalid args are passed in.
+ *         {@link PREFERENCES_ERROR_STORAGE} indicates an storage error.
+ *         {@link PREFERENCES_ERROR_MALLOC} indicates an malloc memory error.
+ * @see OH_Preferences.
+ * @since 14
+ */
+int OH_Preferences_Flush(OH_Preferences *preference);
+
+/**
+ * @brief Schedules all modifications of a Preferences object to be persisted by a background task.
+ * {@Link OH_Preferences_Close} waits for the scheduled tasks, so callback is never called after the Preferences
+ * object is closed.
+ *
+ * @param preference Pointer to the target {@Link OH_Preferences} instance.
+ * @param context Pointer to the context passed to callback.
+ * @param callback the {@Link OH_PreferencesFlushCallback} called when the modifications are written.
+ * It can be null.
+ * @return Returns the status code of the execution.
+ *         {@link PREFERENCES_OK} indicates the flush is scheduled.
+ *         {@link PREFERENCES_ERROR_INVALID_PARAM} indicates invalid args are passed in.
+ *         {@link PREFERENCES_ERROR_MALLOC} indicates an malloc memory error.
+ * @see OH_Preferences OH_PreferencesFlushCallback.
+ * @since 14
+ */
+int OH_Preferences_FlushAsync(OH_Preferences *preference, void *context, OH_PreferencesFlushCallback callback);
+
 /**
  * @brief Registers a data observer for a Preferences object.
  *
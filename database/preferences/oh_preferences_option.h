@@ -45,6 +45,41 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Enumerates the ways modifications of a Preferences object are persisted.
+ *
+ * @since 14
+ */
+typedef enum Preferences_FlushMode {
+    /**
+     * @brief Every modification is persisted before the setter or delete API returns.
+     */
+    PREFERENCES_FLUSH_SYNC = 0,
+    /**
+     * @brief Modifications only update memory. The modified keys are coalesced and persisted by a background task,
+     * which runs about one second after the first modification that is not persisted yet,
+     * or by {@Link OH_Preferences_Flush} and {@Link OH_Preferences_FlushAsync}.
+     * Modifications that are not persisted yet are lost if the process is killed or crashes.
+     */
+    PREFERENCES_FLUSH_ASYNC
+} Preferences_FlushMode;
+
+/**
+ * @brief Enumerates the on-disk formats of a Preferences object.
+ *
+ * @since 14
+ */
+typedef enum Preferences_StorageType {
+    /**
+     * @brief XML file, which is parsed entirely when the Preferences object is opened.
+     */
+    PREFERENCES_STORAGE_XML = 0,
+    /**
+     * @brief Indexed binary file, which is memory-mapped so that values are looked up without parsing the file.
+     */
+    PREFERENCES_STORAGE_BINARY
+} Preferences_StorageType;
+
 /**
  * @brief Represents an OH_PreferencesOption instance.
  *
@@ -101,6 +136,39 @@ int OH_PreferencesOption_SetBundleName(OH_PreferencesOption *option, const char
  */
 int OH_PreferencesOption_SetDataGroupId(OH_PreferencesOption *option, const char *dataGroupId);
 
+/**
+ * @brief Sets the flush mode in an {@Link OH_PreferencesOption} instance.
+ *
+ * @param option Represents a pointer to an {@link OH_PreferencesOption} instance.
+ * @param mode Represents the {@Link Preferences_FlushMode} to set, which is PREFERENCES_FLUSH_SYNC by default.
+ * @return Returns the status code of the execution.
+ *         {@link PREFERENCES_OK} success.
+ *         {@link PREFERENCES_ERROR_INVALID_PARAM} indicates invalid args are passed in.
+ * @see OH_PreferencesOption.
+ * @since 14
+ */
+int OH_PreferencesOption_SetFlushMode(OH_PreferencesOption *option, Preferences_FlushMode mode);
+
+/**
+ * @brief Sets the storage type in an {@Link OH_PreferencesOption} instance.
+ * If the type is PREFERENCES_STORAGE_BINARY and only an XML file exists, the file is converted when the
+ * Preferences object is opened, and the XML file is deleted once the conversion is successful.
+ * If the type is PREFERENCES_STORAGE_XML and only a binary file exists, for example after such a conversion,
+ * the binary file is opened, so the data stays visible to callers that still use the default type.
+ * The binary file is only created, atomically, once the conversion is complete. So if both files exist, for
+ * example after a crash between creating the binary file and deleting the XML file, the binary file wins for
+ * both types: it is opened and the XML file is deleted.
+ *
+ * @param option Represents a pointer to an {@link OH_PreferencesOption} instance.
+ * @param type Represents the {@Link Preferences_StorageType} to set, which is PREFERENCES_STORAGE_XML by default.
+ * @return Returns the status code of the execution.
+ *         {@link PREFERENCES_OK} success.
+ *         {@link PREFERENCES_ERROR_INVALID_PARAM} indicates invalid args are passed in.
+ * @see OH_PreferencesOption.
+ * @since 14
+ */
+int OH_PreferencesOption_SetStorageType(OH_PreferencesOption *option, Preferences_StorageType type);
+
 /**
  * @brief Destroys an {@Link OH_PreferencesOption} instance.
  *
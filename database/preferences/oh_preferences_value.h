@@ -169,6 +169,79 @@ int OH_PreferencesValue_GetBool(const OH_PreferencesValue *object, bool *value);
  * @since 13
  */
 int OH_PreferencesValue_GetString(const OH_PreferencesValue *object, char **value, uint32_t *valueLen);
+
+/**
+ * @brief Obtains the string value of an {@Link OH_PreferencesValue} instance without copying it.
+ *
+ * @param object Pointer to target {@Link OH_PreferencesValue} instance.
+ * @param value Double pointer to the null-terminated string owned by the object. It is valid as long as the object.
+ * @param valueLen Pointer to the string length.
+ * @return Returns the status code of the execution.
+ *         {@link PREFERENCES_OK} indicates the operation is successful.
+ *         {@link PREFERENCES_ERROR_INVALID_PARAM} indicates invalid args are passed in.
+ * @see OH_PreferencesValue.
+ * @since 14
+ */
+int OH_PreferencesValue_GetStringView(const OH_PreferencesValue *object, const char **value, uint32_t *valueLen);
+
+/**
+ * @brief Creates an {@Link OH_PreferencesValue} instance of type PREFERENCE_TYPE_NULL.
+ *
+ * @return Returns a pointer to the {@Link OH_PreferencesValue} instance created if the operation is successful;
+ * returns nullptr otherwise while malloc memory failed.
+ * @see OH_PreferencesValue.
+ * @since 14
+ */
+OH_PreferencesValue *OH_PreferencesValue_Create(void);
+
+/**
+ * @brief Sets an int value to an {@Link OH_PreferencesValue} instance.
+ *
+ * @param object Pointer to the target {@Link OH_PreferencesValue} instance.
+ * @param value Value to set.
+ * @return Returns the status code of the execution.
+ *         {@link PREFERENCES_OK} indicates the operation is successful.
+ *         {@link PREFERENCES_ERROR_INVALID_PARAM} indicates invalid args are passed in.
+ * @see OH_PreferencesValue.
+ * @since 14
+ */
+int OH_PreferencesValue_SetInt(OH_PreferencesValue *object, int value);
+
+/**
+ * @brief Sets a Boolean value to an {@Link OH_PreferencesValue} instance.
+ *
+ * @param object Pointer to the target {@Link OH_PreferencesValue} instance.
+ * @param value Boolean value to set.
+ * @return Returns the status code of the execution.
+ *         {@link PREFERENCES_OK} indicates the operation is successful.
+ *         {@link PREFERENCES_ERROR_INVALID_PARAM} indicates invalid args are passed in.
+ * @see OH_PreferencesValue.
+ * @since 14
+ */
+int OH_PreferencesValue_SetBool(OH_PreferencesValue *object, bool value);
+
+/**
+ * @brief Sets a string value to an {@Link OH_PreferencesValue} instance. The string is copied.
+ *
+ * @param object Pointer to the target {@Link OH_PreferencesValue} instance.
+ * @param value Point to string to set.
+ * @return Returns the status code of the execution.
+ *         {@link PREFERENCES_OK} indicates the operation is successful.
+ *         {@link PREFERENCES_ERROR_INVALID_PARAM} indicates invalid args are passed in.
+ *         {@link PREFERENCES_ERROR_MALLOC} indicates an malloc memory error.
+ * @see OH_PreferencesValue.
+ * @since 14
+ */
+int OH_PreferencesValue_SetString(OH_PreferencesValue *object, const char *value);
+
+/**
+ * @brief Destroys an {@Link OH_PreferencesValue} instance created by {@Link OH_PreferencesValue_Create}.
+ *
+ * @param object Pointer to the {@Link OH_PreferencesValue} instance to destroy.
+ * @see OH_PreferencesValue.
+ * @since 14
+ */
+void OH_PreferencesValue_Destroy(OH_PreferencesValue *object);
 #ifdef __cplusplus
 };
 #endif
@@ -100,6 +100,46 @@ typedef enum OH_ColumnType {
  */
 typedef struct OH_Cursor OH_Cursor;
 
+/**
+ * @brief Describes a caller-provided buffer that receives the values of one column for many rows.
+ *
+ * @since 14
+ */
+typedef struct OH_Cursor_ColumnBuffer {
+    /**
+     * Indicates the zero-based index of the column to fetch.
+     */
+    int32_t columnIndex;
+    /**
+     * Indicates the {@link OH_ColumnType} the values are converted to.
+     * Only TYPE_INT64, TYPE_REAL, TYPE_TEXT and TYPE_BLOB are supported.
+     */
+    OH_ColumnType type;
+    /**
+     * Indicates the values. For TYPE_INT64 and TYPE_REAL it is an array of int64_t or double,
+     * which must hold maxRows elements, where maxRows is the parameter of fetchColumns.
+     * For TYPE_TEXT and TYPE_BLOB it is a byte buffer holding the values of all rows back to back,
+     * text values without terminator.
+     */
+    void *values;
+    /**
+     * Indicates the capacity of values in bytes. It is only used for TYPE_TEXT and TYPE_BLOB.
+     */
+    size_t capacity;
+    /**
+     * Indicates the offsets of the values in values, for TYPE_TEXT and TYPE_BLOB only.
+     * It must hold maxRows + 1 elements, where maxRows is the parameter of fetchColumns;
+     * the value of row i is in [offsets[i], offsets[i + 1]).
+     */
+    size_t *offsets;
+    /**
+     * Indicates whether the value of each row is NULL, which must hold maxRows elements.
+     * It can be NULL if the caller does not need it.
+     * NULL values are written as 0 for TYPE_INT64 and TYPE_REAL and as empty values for TYPE_TEXT and TYPE_BLOB.
+     */
+    bool *isNull;
+} OH_Cursor_ColumnBuffer;
+
 /**
  * @brief Define the OH_Cursor structure type.
  *
@@ -300,6 +340,30 @@ struct OH_Cursor {
      * @since 11
      */
     int (*getAssets)(OH_Cursor *cursor, int32_t columnIndex, Data_Asset **value, uint32_t *length);
+
+    /**
+     * @brief Function pointer. Moves the cursor forward over up to maxRows rows and fetches
+     * the requested columns of these rows into the given buffers.
+     *
+     * The first fetched row is the row that {@link goToNextRow} would move to. Fewer rows are fetched
+     * at the end of the result set, or when a TYPE_TEXT or TYPE_BLOB buffer is full.
+     *
+     * @param cursor Represents a pointer to an {@link OH_Cursor} instance.
+     * @param maxRows Indicates the maximum number of rows to fetch.
+     * @param columns Indicates the array of {@link OH_Cursor_ColumnBuffer}, one element per column to fetch.
+     * @param columnCount Indicates the number of elements of columns.
+     * @param rowCount This parameter is the output parameter, and the number of fetched rows is written to this
+     * variable. It is 0 at the end of the result set.
+     * @return Returns the status code of the execution.
+     *     {@link RDB_OK} - success.
+     *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args,
+     *     or a TYPE_TEXT or TYPE_BLOB buffer cannot hold the values of one row.
+     *     {@link RDB_E_INVALID_COLUMN_INDEX} - A column index is out of range.
+     * @see OH_Cursor, OH_Cursor_ColumnBuffer.
+     * @since 14
+     */
+    int (*fetchColumns)(OH_Cursor *cursor, uint32_t maxRows, OH_Cursor_ColumnBuffer *columns, uint32_t columnCount,
+        uint32_t *rowCount);
 };
 
 #ifdef __cplusplus
@@ -363,6 +363,8 @@ struct OH_Predicates {
      * Configure the predicate to match the specified field and the value within the given array range.
      *
      * This method is similar IN the SQL statement.
+     * The values of valueObject are bound as one array parameter instead of being inlined into the SQL statement,
+     * so the statement text does not depend on the number of values and the compiled statement can be reused.
      *
      * @param predicates Represents a pointer to an {@link OH_Predicates} instance.
      * @param field Indicates the column name in the database table.
@@ -378,6 +380,8 @@ struct OH_Predicates {
      * Configure the predicate to match the specified field and the value not within the given array range.
      *
      * This method is similar NOT IN the SQL statement.
+     * The values of valueObject are bound as one array parameter instead of being inlined into the SQL statement,
+     * so the statement text does not depend on the number of values and the compiled statement can be reused.
      *
      * @param predicates Represents a pointer to an {@link OH_Predicates} instance.
      * @param field Indicates the column name in the database table.
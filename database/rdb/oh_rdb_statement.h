@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OH_RDB_STATEMENT_H
+#define OH_RDB_STATEMENT_H
+
+/**
+ * @addtogroup RDB
+ * @{
+ *
+ * @brief The relational database (RDB) store manages data based on relational models.
+ * With the underlying SQLite database, the RDB store provides a complete mechanism for managing local databases.
+ * To satisfy different needs in complicated scenarios, the RDB store offers a series of APIs for performing operations
+ * such as adding, deleting, modifying, and querying data, and supports direct execution of SQL statements.
+ *
+ * @syscap SystemCapability.DistributedDataManager.RelationalStore.Core
+ * @since 10
+ */
+
+/**
+ * @file oh_rdb_statement.h
+ *
+ * @brief Provides functions related to prepared statements.
+ * A prepared statement is compiled once by {@link OH_Rdb_Prepare} and can then be bound and executed many times.
+ *
+ * @kit ArkData
+ * @since 14
+ */
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#endif
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "database/rdb/oh_cursor.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Define the OH_Rdb_Statement structure type.
+ *
+ * Represents a compiled SQL statement of an RDB store.
+ *
+ * @since 14
+ */
+typedef struct OH_Rdb_Statement OH_Rdb_Statement;
+
+/**
+ * @brief Binds an int64 value to a parameter of the statement.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @param index Indicates the zero-based index of the parameter.
+ * @param value Indicates the int64 value.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_INVALID_BIND_ARGS_COUNT} - index is out of range.
+ *     {@link RDB_E_INVALID_STATEMENT} - The statement has been stepped and not reset by {@link OH_RdbStmt_Reset}.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_BindInt64(OH_Rdb_Statement *stmt, int32_t index, int64_t value);
+
+/**
+ * @brief Binds a double value to a parameter of the statement.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @param index Indicates the zero-based index of the parameter.
+ * @param value Indicates the double value.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_INVALID_BIND_ARGS_COUNT} - index is out of range.
+ *     {@link RDB_E_INVALID_STATEMENT} - The statement has been stepped and not reset by {@link OH_RdbStmt_Reset}.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_BindReal(OH_Rdb_Statement *stmt, int32_t index, double value);
+
+/**
+ * @brief Binds a text value to a parameter of the statement. The value is copied.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @param index Indicates the zero-based index of the parameter.
+ * @param value Indicates the const char * value.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_INVALID_BIND_ARGS_COUNT} - index is out of range.
+ *     {@link RDB_E_INVALID_STATEMENT} - The statement has been stepped and not reset by {@link OH_RdbStmt_Reset}.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_BindText(OH_Rdb_Statement *stmt, int32_t index, const char *value);
+
+/**
+ * @brief Binds a blob value to a parameter of the statement. The value is copied.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @param index Indicates the zero-based index of the parameter.
+ * @param value Indicates the const uint8_t * value.
+ * @param size Indicates the size of value.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_INVALID_BIND_ARGS_COUNT} - index is out of range.
+ *     {@link RDB_E_INVALID_STATEMENT} - The statement has been stepped and not reset by {@link OH_RdbStmt_Reset}.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_BindBlob(OH_Rdb_Statement *stmt, int32_t index, const uint8_t *value, uint32_t size);
+
+/**
+ * @brief Binds NULL to a parameter of the statement.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @param index Indicates the zero-based index of the parameter.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_INVALID_BIND_ARGS_COUNT} - index is out of range.
+ *     {@link RDB_E_INVALID_STATEMENT} - The statement has been stepped and not reset by {@link OH_RdbStmt_Reset}.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_BindNull(OH_Rdb_Statement *stmt, int32_t index);
+
+/**
+ * @brief Executes the statement until the next result row or until it is complete.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @param hasRow This parameter is the output parameter. True is written to it if a result row is available,
+ * and false if the statement is complete.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ * Specific error codes can be referenced {@link OH_Rdb_ErrCode}.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_Step(OH_Rdb_Statement *stmt, bool *hasRow);
+
+/**
+ * @brief Obtains the number of columns of the result rows.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @param count This parameter is the output parameter, and the number of columns is written to this variable.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_GetColumnCount(OH_Rdb_Statement *stmt, int *count);
+
+/**
+ * @brief Obtains the data type of a column of the current result row.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @param columnIndex Indicates the zero-based column index.
+ * @param columnType This parameter is the output parameter, and the column value type is written to this variable.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_INVALID_COLUMN_INDEX} - columnIndex is out of range.
+ *     {@link RDB_E_NO_ROW_IN_QUERY} - There is no current result row, because the statement has not been
+ *     stepped since it was prepared or reset, or the last step did not return a row.
+ * @see OH_Rdb_Statement, OH_ColumnType.
+ * @since 14
+ */
+int OH_RdbStmt_GetColumnType(OH_Rdb_Statement *stmt, int32_t columnIndex, OH_ColumnType *columnType);
+
+/**
+ * @brief Obtains the value of a column of the current result row as an int64_t.
+ * A value of another type is converted: NULL to 0, a double by truncation, and a string or byte array by
+ * parsing its leading integer, or to 0 if it has none.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @param columnIndex Indicates the zero-based column index.
+ * @param value This parameter is the output parameter, and the value is written to this variable.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_INVALID_COLUMN_INDEX} - columnIndex is out of range.
+ *     {@link RDB_E_NO_ROW_IN_QUERY} - There is no current result row, because the statement has not been
+ *     stepped since it was prepared or reset, or the last step did not return a row.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_GetInt64(OH_Rdb_Statement *stmt, int32_t columnIndex, int64_t *value);
+
+/**
+ * @brief Obtains the value of a column of the current result row as a double.
+ * A value of another type is converted: NULL to 0.0, an integer exactly if possible, and a string or byte array
+ * by parsing its leading number, or to 0.0 if it has none.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @param columnIndex Indicates the zero-based column index.
+ * @param value This parameter is the output parameter, and the value is written to this variable.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_INVALID_COLUMN_INDEX} - columnIndex is out of range.
+ *     {@link RDB_E_NO_ROW_IN_QUERY} - There is no current result row, because the statement has not been
+ *     stepped since it was prepared or reset, or the last step did not return a row.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_GetReal(OH_Rdb_Statement *stmt, int32_t columnIndex, double *value);
+
+/**
+ * @brief Obtains the value of a column of the current result row as a string.
+ * A value of another type is converted: NULL to an empty string, and an integer or a double to its text
+ * representation. A byte array is returned as is, with a terminator appended.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @param columnIndex Indicates the zero-based column index.
+ * @param value This parameter is the output parameter, and a pointer to the null-terminated string is written
+ * to this variable. The string is owned by the statement and is valid until the next step, reset or finalize.
+ * @param size This parameter is the output parameter, and the length of the string without the terminator
+ * is written to this variable.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_INVALID_COLUMN_INDEX} - columnIndex is out of range.
+ *     {@link RDB_E_NO_ROW_IN_QUERY} - There is no current result row, because the statement has not been
+ *     stepped since it was prepared or reset, or the last step did not return a row.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_GetText(OH_Rdb_Statement *stmt, int32_t columnIndex, const char **value, size_t *size);
+
+/**
+ * @brief Obtains the value of a column of the current result row as a byte array.
+ * A value of another type is converted: NULL to an empty array, a string to its bytes without the terminator,
+ * and an integer or a double to the bytes of its text representation.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @param columnIndex Indicates the zero-based column index.
+ * @param value This parameter is the output parameter, and a pointer to the bytes is written to this variable.
+ * The bytes are owned by the statement and are valid until the next step, reset or finalize.
+ * @param size This parameter is the output parameter, and the number of bytes is written to this variable.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_INVALID_COLUMN_INDEX} - columnIndex is out of range.
+ *     {@link RDB_E_NO_ROW_IN_QUERY} - There is no current result row, because the statement has not been
+ *     stepped since it was prepared or reset, or the last step did not return a row.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_GetBlob(OH_Rdb_Statement *stmt, int32_t columnIndex, const uint8_t **value, size_t *size);
+
+/**
+ * @brief Obtains the number of rows changed by the last completed INSERT, UPDATE or DELETE statement.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @param changes This parameter is the output parameter, and the number of rows is written to this variable.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_GetChanges(OH_Rdb_Statement *stmt, int64_t *changes);
+
+/**
+ * @brief Resets the statement so that it can be executed again. Bound values are kept.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_Reset(OH_Rdb_Statement *stmt);
+
+/**
+ * @brief Sets all parameters of the statement to NULL.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_ClearBindings(OH_Rdb_Statement *stmt);
+
+/**
+ * @brief Destroys the statement and reclaims the memory occupied by it.
+ *
+ * The statement pointer must not be used after this call.
+ *
+ * @param stmt Represents a pointer to an {@link OH_Rdb_Statement} instance.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ * @see OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_RdbStmt_Finalize(OH_Rdb_Statement *stmt);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif // OH_RDB_STATEMENT_H
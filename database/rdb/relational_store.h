@@ -40,6 +40,7 @@
 
 #include "database/rdb/oh_cursor.h"
 #include "database/rdb/oh_predicates.h"
+#include "database/rdb/oh_rdb_statement.h"
 #include "database/rdb/oh_value_object.h"
 #include "database/rdb/oh_values_bucket.h"
 
@@ -101,6 +102,30 @@ typedef enum Rdb_SecurityArea {
     RDB_SECURITY_AREA_EL5,
 } Rdb_SecurityArea;
 
+/**
+ * @brief Describes the checkpoint mode of a database in WAL mode.
+ *
+ * @since 14
+ */
+typedef enum Rdb_CheckpointMode {
+    /**
+     * @brief Checkpoints as many frames as possible without waiting for readers or writers.
+     */
+    RDB_CHECKPOINT_PASSIVE = 0,
+    /**
+     * @brief Waits for writers, then checkpoints all frames.
+     */
+    RDB_CHECKPOINT_FULL,
+    /**
+     * @brief Like RDB_CHECKPOINT_FULL, and also waits for readers so the next writer restarts the WAL file.
+     */
+    RDB_CHECKPOINT_RESTART,
+    /**
+     * @brief Like RDB_CHECKPOINT_RESTART, and also truncates the WAL file to zero bytes.
+     */
+    RDB_CHECKPOINT_TRUNCATE
+} Rdb_CheckpointMode;
+
 /**
  * @brief Manages relational database configurations.
  *
@@ -142,6 +167,31 @@ typedef struct {
      * @since 11
      */
     int area;
+    /**
+     * Indicates the number of read-only connections of the database, which is opened in WAL mode.
+     * Queries from different threads run in parallel on the read-only connections and writes stay serialized
+     * on one write connection.
+     * If it is 0, the default number of read-only connections is used, as for callers whose selfSize does not
+     * include this field. If it is -1, no read-only connection is opened and all operations share the write
+     * connection. If it is less than -1, {@link OH_Rdb_GetOrOpen} fails with {@link RDB_E_INVALID_ARGS},
+     * and if it exceeds the supported maximum, with {@link RDB_E_ARGS_READ_CON_OVERLOAD}.
+     *
+     * @since 14
+     */
+    int readConnSize;
+    /**
+     * Indicates the number of WAL pages after which a {@link Rdb_CheckpointMode} checkpoint runs automatically.
+     * If it is 0, the default threshold is used. If it is negative, automatic checkpoints are disabled.
+     *
+     * @since 14
+     */
+    int autoCheckpointPages;
+    /**
+     * Indicates the {@link Rdb_CheckpointMode} of automatic checkpoints.
+     *
+     * @since 14
+     */
+    int checkpointMode;
 } OH_Rdb_Config;
 #pragma pack()
 
@@ -248,6 +298,52 @@ int OH_Rdb_DeleteStore(const OH_Rdb_Config *config);
  */
 int OH_Rdb_Insert(OH_Rdb_Store *store, const char *table, OH_VBucket *valuesBucket);
 
+/**
+ * @brief Describes the conflict resolution used when an inserted row violates a constraint.
+ *
+ * @since 14
+ */
+typedef enum Rdb_ConflictResolution {
+    /**
+     * @brief Stops the batch and rolls back all rows inserted by it.
+     */
+    RDB_CONFLICT_ABORT = 1,
+    /**
+     * @brief Skips the conflicting row and continues with the next one.
+     */
+    RDB_CONFLICT_IGNORE,
+    /**
+     * @brief Deletes the existing conflicting rows and inserts the new row.
+     */
+    RDB_CONFLICT_REPLACE
+} Rdb_ConflictResolution;
+
+/**
+ * @brief Inserts a batch of rows into the target table.
+ *
+ * The INSERT statement is compiled once and reused for every row that has the same columns,
+ * and all rows are inserted in one transaction. If a transaction was begun by
+ * {@link OH_Rdb_BeginTransaction}, the rows are inserted in that transaction instead.
+ *
+ * @param store Represents a pointer to an {@link OH_Rdb_Store} instance.
+ * @param table Indicates the target table.
+ * @param rows Indicates the rows of data {@link OH_VBucket} to be inserted into the table.
+ * @param count Indicates the count of rows.
+ * @param resolution Indicates the {@link Rdb_ConflictResolution} applied to conflicting rows.
+ * @param outRowIds This parameter is the output parameter. If it is not NULL, it must hold count elements,
+ * and the rowId of each row is written to it, or -1 if the row was ignored.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_INVALID_CONFLICT_FLAG} - resolution is not a value of {@link Rdb_ConflictResolution}.
+ *     {@link RDB_E_ERROR} - A row conflicts and resolution is RDB_CONFLICT_ABORT. No row is inserted.
+ * Specific error codes can be referenced {@link OH_Rdb_ErrCode}.
+ * @see OH_Rdb_Store, OH_VBucket, Rdb_ConflictResolution, OH_Rdb_ErrCode.
+ * @since 14
+ */
+int OH_Rdb_BatchInsert(OH_Rdb_Store *store, const char *table, OH_VBucket **rows, uint32_t count,
+    Rdb_ConflictResolution resolution, int64_t *outRowIds);
+
 /**
  * @brief Updates data in the database based on specified conditions.
  *
@@ -294,6 +390,62 @@ int OH_Rdb_Delete(OH_Rdb_Store *store, OH_Predicates *predicates);
  */
 OH_Cursor *OH_Rdb_Query(OH_Rdb_Store *store, OH_Predicates *predicates, const char *const *columnNames, int length);
 
+/**
+ * @brief Indicates version of {@link Rdb_CursorWindowConfig}
+ *
+ * @since 14
+ */
+#define CURSOR_WINDOW_CONFIG_VERSION 1
+
+/**
+ * @brief Manages the prefetch window of a cursor returned by {@link OH_Rdb_QueryWithWindow}.
+ *
+ * @since 14
+ */
+typedef struct Rdb_CursorWindowConfig {
+    /**
+     * The version used to uniquely identify the Rdb_CursorWindowConfig struct.
+     */
+    int version;
+    /**
+     * Indicates the number of rows materialized at a time. If it is 0, a default page size is used.
+     */
+    uint32_t pageSize;
+    /**
+     * Indicates the number of pages materialized ahead of the cursor by a background task.
+     * If it is 0, a page is only materialized when the cursor moves into it.
+     */
+    uint32_t prefetchPages;
+} Rdb_CursorWindowConfig;
+
+/**
+ * @brief Queries data in the database based on specified conditions, materializing the result lazily in pages.
+ *
+ * At most pageSize * (prefetchPages + 1) rows are held in memory, and the first row is available as soon as
+ * the first page is materialized. The total number of rows is not known in advance, so getRowCount of the
+ * returned cursor fails with {@link RDB_E_NOT_SUPPORTED_BY_STEP_RESULT_SET} until the last row has been reached.
+ *
+ * All pages are read from one snapshot of the database: the cursor holds a read transaction on a read-only
+ * connection from the first page until the last row has been reached or the cursor is destroyed, so it does not
+ * see writes committed after the first page. While the read transaction is held, checkpoints cannot move past
+ * the snapshot and the WAL file keeps growing with every write, until writes fail with
+ * {@link RDB_E_WAL_SIZE_OVER_LIMIT}. Destroy the cursor as soon as it is no longer needed, and split very long
+ * scans that run concurrently with writes into several queries over ranges of a key.
+ *
+ * @param store Represents a pointer to an {@link OH_Rdb_Store} instance.
+ * @param predicates Represents a pointer to an {@link OH_Predicates} instance.
+ * Indicates the specified query condition.
+ * @param columnNames Indicates the columns to query. If the value is empty array, the query applies to all columns.
+ * @param length Indicates the length of columnNames.
+ * @param config Indicates the prefetch window of the cursor. For details, see {@link Rdb_CursorWindowConfig}.
+ * @return If the query is successful, a pointer to the instance of the @link OH_Cursor} structure is returned.
+ *         If Get store failed, config is invalid or resultSet is nullptr, nullptr is returned.
+ * @see OH_Rdb_Store, OH_Predicates, OH_Cursor, Rdb_CursorWindowConfig.
+ * @since 14
+ */
+OH_Cursor *OH_Rdb_QueryWithWindow(OH_Rdb_Store *store, OH_Predicates *predicates, const char *const *columnNames,
+    int length, const Rdb_CursorWindowConfig *config);
+
 /**
  * @brief Executes an SQL statement.
  *
@@ -319,6 +471,26 @@ int OH_Rdb_Execute(OH_Rdb_Store *store, const char *sql);
  */
 OH_Cursor *OH_Rdb_ExecuteQuery(OH_Rdb_Store *store, const char *sql);
 
+/**
+ * @brief Compiles an SQL statement into a reusable {@link OH_Rdb_Statement}.
+ *
+ * The statement may contain '?' parameters, which are bound by the OH_RdbStmt_Bind functions.
+ *
+ * @param store Represents a pointer to an {@link OH_Rdb_Store} instance.
+ * @param sql Indicates the SQL statement to compile.
+ * @param stmt This parameter is the output parameter, and a pointer to the compiled statement is written to it.
+ * It must be destroyed by {@link OH_RdbStmt_Finalize} before the store is closed.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_ERROR} - The SQL statement cannot be compiled, for example because of a syntax error or an
+ *     unknown table or column.
+ * Specific error codes can be referenced {@link OH_Rdb_ErrCode}.
+ * @see OH_Rdb_Store, OH_Rdb_Statement.
+ * @since 14
+ */
+int OH_Rdb_Prepare(OH_Rdb_Store *store, const char *sql, OH_Rdb_Statement **stmt);
+
 /**
  * @brief Begins a transaction in EXCLUSIVE mode.
  *
@@ -355,6 +527,20 @@ int OH_Rdb_RollBack(OH_Rdb_Store *store);
  */
 int OH_Rdb_Commit(OH_Rdb_Store *store);
 
+/**
+ * @brief Runs a checkpoint that copies the WAL content of a database in WAL mode into the database file.
+ *
+ * @param store Represents a pointer to an {@link OH_Rdb_Store} instance.
+ * @param mode Indicates the {@link Rdb_CheckpointMode} of the checkpoint.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_NOT_SUPPORT} - The database is not in WAL mode.
+ * @see OH_Rdb_Store, Rdb_CheckpointMode.
+ * @since 14
+ */
+int OH_Rdb_Checkpoint(OH_Rdb_Store *store, Rdb_CheckpointMode mode);
+
 /**
  * @brief Backs up a database on specified path.
  *
@@ -368,6 +554,76 @@ int OH_Rdb_Commit(OH_Rdb_Store *store);
  */
 int OH_Rdb_Backup(OH_Rdb_Store *store, const char *databasePath);
 
+/**
+ * @brief The callback function of backup progress.
+ *
+ * @param context Represents the context of {@link Rdb_BackupOptions}.
+ * @param copiedPages Indicates the number of pages copied so far.
+ * @param totalPages Indicates the number of pages to copy.
+ * @return Returns true to continue the backup, or false to cancel it.
+ * @since 14
+ */
+typedef bool (*Rdb_BackupProgressCallback)(void *context, uint64_t copiedPages, uint64_t totalPages);
+
+/**
+ * @brief Indicates version of {@link Rdb_BackupOptions}
+ *
+ * @since 14
+ */
+#define BACKUP_OPTIONS_VERSION 1
+
+/**
+ * @brief Manages the options of an online backup.
+ *
+ * @since 14
+ */
+typedef struct Rdb_BackupOptions {
+    /**
+     * The version used to uniquely identify the Rdb_BackupOptions struct.
+     */
+    int version;
+    /**
+     * Specifies whether only the pages changed since the last backup to the same path are copied.
+     * If the file at the path is not a backup of this database, all pages are copied.
+     */
+    bool isIncremental;
+    /**
+     * Indicates the number of pages copied per step. Writers are only blocked during a step.
+     * If it is 0, a default number is used.
+     */
+    uint32_t pagesPerStep;
+    /**
+     * Indicates the pause between two steps in milliseconds, which throttles the backup I/O.
+     */
+    uint32_t stepIntervalMs;
+    /**
+     * The context of callback.
+     */
+    void *context;
+    /**
+     * The {@link Rdb_BackupProgressCallback} called after every step. It can be NULL.
+     */
+    Rdb_BackupProgressCallback callback;
+} Rdb_BackupOptions;
+
+/**
+ * @brief Backs up a database on specified path online, in steps, without blocking writers for the whole backup.
+ *
+ * Pages changed by writers after they were copied are copied again in a later step, so the backup is consistent
+ * when it completes. If the backup is cancelled or fails, the file at databasePath is left unchanged.
+ *
+ * @param store Represents a pointer to an {@link OH_Rdb_Store} instance.
+ * @param databasePath Indicates the database file path.
+ * @param options Indicates the backup options. For details, see {@link Rdb_BackupOptions}.
+ * @return Returns the status code of the execution.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ *     {@link RDB_E_ERROR} - The backup is cancelled by the callback.
+ * @see OH_Rdb_Store, Rdb_BackupOptions.
+ * @since 14
+ */
+int OH_Rdb_BackupWithOptions(OH_Rdb_Store *store, const char *databasePath, const Rdb_BackupOptions *options);
+
 /**
  * @brief Restores a database from a specified database file.
  *
@@ -672,6 +928,84 @@ typedef struct Rdb_DataObserver {
  */
 int OH_Rdb_Subscribe(OH_Rdb_Store *store, Rdb_SubscribeType type, const Rdb_DataObserver *observer);
 
+/**
+ * @brief The function used to run a notification task on a thread chosen by the subscriber.
+ *
+ * @param context Represents the dispatchContext of {@link Rdb_SubscribeOptions}.
+ * @param task Indicates the notification task, which must be called exactly once with arg, even after the observer
+ * has been removed by {@link OH_Rdb_Unsubscribe}.
+ * @param arg Indicates the argument of task.
+ * @since 14
+ */
+typedef void (*Rdb_Dispatcher)(void *context, void (*task)(void *arg), void *arg);
+
+/**
+ * @brief Indicates version of {@link Rdb_SubscribeOptions}
+ *
+ * @since 14
+ */
+#define SUBSCRIBE_OPTIONS_VERSION 1
+
+/**
+ * @brief Manages how local data change details are coalesced and delivered.
+ *
+ * @since 14
+ */
+typedef struct Rdb_SubscribeOptions {
+    /**
+     * The version used to uniquely identify the Rdb_SubscribeOptions struct.
+     */
+    int version;
+    /**
+     * Indicates the time window in milliseconds over which changes are collected before they are delivered.
+     * Within a window, all changes of one primary key, or of one row-id for tables without a primary key,
+     * are merged by whether a row with that key exists before and after the window:
+     * - it exists before and after, for example after updates, or a delete followed by an insert, which includes
+     *   a row-id reused by a new row: reported as updated;
+     * - it exists only after, for example after an insert followed by updates: reported as inserted;
+     * - it exists only before, for example after updates followed by a delete: reported as deleted;
+     * - it exists neither before nor after, for example after an insert followed by a delete: not reported.
+     * If it is 0, changes are delivered after every commit.
+     */
+    uint32_t coalesceWindowMs;
+    /**
+     * Indicates the function used to deliver notifications. If it is NULL, notifications are delivered
+     * on an internal thread.
+     */
+    Rdb_Dispatcher dispatcher;
+    /**
+     * Indicates the context passed to dispatcher.
+     */
+    void *dispatchContext;
+} Rdb_SubscribeOptions;
+
+/**
+ * @brief Registers an observer of local row-level data changes with coalesced delivery.
+ *
+ * The observer receives one {@link Rdb_ChangeInfo} per changed table, with the primary keys or row-ids of the
+ * inserted, updated and deleted rows, through its detailsObserver callback.
+ * Changes collected but not delivered yet are discarded when the observer is removed by {@link OH_Rdb_Unsubscribe}.
+ * Tasks already passed to the dispatcher stay valid, but once OH_Rdb_Unsubscribe has returned they only release
+ * their argument and no longer call detailsObserver. If detailsObserver is running on another thread,
+ * OH_Rdb_Unsubscribe waits until it returns, unless it is called from detailsObserver itself.
+ * So the context of the observer and dispatchContext can be freed as soon as OH_Rdb_Unsubscribe returns,
+ * although the dispatched tasks must still be run.
+ *
+ * @param store Represents a pointer to an {@link OH_Rdb_Store} instance.
+ * @param type Indicates the subscription type. Only RDB_SUBSCRIBE_TYPE_LOCAL_DETAILS is supported.
+ * @param observer The {@link Rdb_DataObserver} of change events in the database.
+ * @param options Indicates the coalescing and delivery options. For details, see {@link Rdb_SubscribeOptions}.
+ * @return Returns the status code of the execution. See {@link OH_Rdb_ErrCode}.
+ *     {@link RDB_OK} - success.
+ *     {@link RDB_E_INVALID_ARGS} - The error code for common invalid args.
+ * @see OH_Rdb_Store.
+ * @see Rdb_DataObserver.
+ * @see Rdb_SubscribeOptions.
+ * @since 14
+ */
+int OH_Rdb_SubscribeWithOptions(OH_Rdb_Store *store, Rdb_SubscribeType type, const Rdb_DataObserver *observer,
+    const Rdb_SubscribeOptions *options);
+
 /**
  * @brief Remove specified observer of specified type from the database.
  *
@@ -356,6 +356,9 @@ int OH_UdmfRecord_AddPixelMap(OH_UdmfRecord* pThis, OH_UdsPixelMap* pixelMap);
 
 /**
  * @brief Add one {@link OH_UdsArrayBuffer} data to the {@link OH_UdmfRecord} record.
+ * Data set by {@link OH_UdsArrayBuffer_SetSharedMemory} is shared with the record instead of being copied.
+ * The record holds its own reference to the shared memory, so the buffer can be destroyed right after this call,
+ * as with copied data, and the shared memory stays valid until the record is destroyed.
  *
  * @param record Represents a pointer to an instance of {@link OH_UdmfRecord}.
  * @param type Represents record type, reference udmf_meta.h.
@@ -639,6 +639,8 @@ int OH_UdsArrayBuffer_Destroy(OH_UdsArrayBuffer* buffer);
 
 /**
  * @brief Set array buffer data to the {@link OH_UdsArrayBuffer}.
+ * If the buffer was backed by shared memory set by {@link OH_UdsArrayBuffer_SetSharedMemory}, the buffer releases
+ * its reference to it, and the file descriptor is closed once no record shares it any more.
  *
  * @param buffer Represents a pointer to an instance of {@link OH_UdsArrayBuffer}.
  * @param data Represents the array buffer data.
@@ -653,6 +655,8 @@ int OH_UdsArrayBuffer_SetData(OH_UdsArrayBuffer* buffer, unsigned char* data, un
 
 /**
  * @brief Get array buffer data from the {@link OH_UdsArrayBuffer}.
+ * If the data is backed by shared memory, a private copy of it is made on the first call and owned by the buffer,
+ * so that it can be written through data. Use {@link OH_UdsArrayBuffer_GetMappedData} to read it without copying.
  *
  * @param buffer Represents a pointer to an instance of {@link OH_UdsArrayBuffer}.
  * @param data Represents a pointer to array buffer data that is a output param.
@@ -665,6 +669,45 @@ int OH_UdsArrayBuffer_SetData(OH_UdsArrayBuffer* buffer, unsigned char* data, un
  */
 int OH_UdsArrayBuffer_GetData(OH_UdsArrayBuffer* buffer, unsigned char** data, unsigned int* len);
 
+/**
+ * @brief Set shared memory as the array buffer data of the {@link OH_UdsArrayBuffer}.
+ * The data is not copied. When the record is written to UDMF or the Pasteboard, the file descriptor is
+ * handed over instead of the content, and consumers map it read-only.
+ * The shared memory must be immutable, so that consumers can neither observe later changes nor fault on
+ * a truncated mapping: a memfd must carry the seals F_SEAL_SHRINK, F_SEAL_GROW and F_SEAL_WRITE, and an
+ * ashmem region must have its protection mask restricted to PROT_READ.
+ *
+ * @param buffer Represents a pointer to an instance of {@link OH_UdsArrayBuffer}.
+ * @param fd Represents a file descriptor of sealed shared memory, such as a memfd or ashmem region.
+ * The ownership of fd is transferred to buffer only if this call succeeds. Otherwise the caller still owns
+ * fd and must close it.
+ * @param len Represents the length of the data in the shared memory, which must not exceed its size.
+ * @return Returns the status code of the execution. See {@link Udmf_ErrCode}.
+ *         {@link UDMF_E_OK} success.
+ *         {@link UDMF_E_INVALID_PARAM} The error code for common invalid args, or fd is not sealed shared memory
+ *         as described above.
+ * @see OH_UdsArrayBuffer Udmf_ErrCode
+ * @since 14
+ */
+int OH_UdsArrayBuffer_SetSharedMemory(OH_UdsArrayBuffer* buffer, int fd, unsigned int len);
+
+/**
+ * @brief Get a read-only view of the array buffer data from the {@link OH_UdsArrayBuffer} without copying it.
+ * If the data is backed by shared memory, it is mapped on first access.
+ *
+ * @param buffer Represents a pointer to an instance of {@link OH_UdsArrayBuffer}.
+ * @param data Represents a pointer to the read-only data that is a output param.
+ * It is valid until the buffer is destroyed.
+ * @param len Represents the array buffer data length that is a output param.
+ * @return Returns the status code of the execution. See {@link Udmf_ErrCode}.
+ *         {@link UDMF_E_OK} success.
+ *         {@link UDMF_E_INVALID_PARAM} The error code for common invalid args.
+ *         {@link UDMF_ERR} Internal data error, for example the shared memory cannot be mapped.
+ * @see OH_UdsArrayBuffer Udmf_ErrCode
+ * @since 14
+ */
+int OH_UdsArrayBuffer_GetMappedData(OH_UdsArrayBuffer* buffer, const unsigned char** data, unsigned int* len);
+
 #ifdef __cplusplus
 };
 #endif
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup Ffrt
+ * @{
+ *
+ * @brief ffrt provides APIs.
+ *
+ *
+ * @syscap SystemCapability.Resourceschedule.Ffrt.Core
+ *
+ * @since 14
+ */
+
+ /**
+ * @file graph.h
+ * @kit FunctionFlowRuntimeKit
+ *
+ * @brief Declares the task graph interfaces in C.
+ *
+ * A task graph records the tasks submitted by {@link ffrt_submit_base} and {@link ffrt_submit_h_base}
+ * together with their dependency edges, and can then be launched many times without rebuilding
+ * the dependency tracking.
+ *
+ * @syscap SystemCapability.Resourceschedule.Ffrt.Core
+ * @since 14
+ * @version 1.0
+ */
+#ifndef FFRT_API_C_GRAPH_H
+#define FFRT_API_C_GRAPH_H
+#include <stdint.h>
+#include "type_def.h"
+
+/**
+ * @brief Defines the ffrt task graph type.
+ *
+ * @since 14
+ */
+typedef void* ffrt_graph_t;
+
+/**
+ * @brief Starts capturing the tasks submitted by the calling thread into a graph.
+ *
+ * Until {@link ffrt_graph_end_capture} is called, tasks submitted by the calling thread are recorded
+ * as graph nodes, in submission order, instead of being executed. Task handles returned during capture
+ * can only be used as task dependencies of other captured tasks.
+ * Because captured tasks do not run, the capturing thread must not wait for them. If it calls {@link ffrt_wait}
+ * or {@link ffrt_wait_deps} during capture, the call returns immediately without waiting and the capture fails,
+ * so that {@link ffrt_graph_end_capture} discards the captured tasks and returns a null pointer.
+ * Discarded tasks are not executed, but their executors are destroyed by the runtime, as for a graph destroyed
+ * by {@link ffrt_graph_destroy}.
+ *
+ * @return {@link ffrt_success} 0 - success.
+ *         {@link ffrt_error_busy} 16 - if the calling thread is already capturing.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_graph_begin_capture(void);
+
+/**
+ * @brief Stops capturing and obtains the captured graph.
+ *
+ * @return Returns a non-null graph handle if the graph is created;
+           returns a null pointer if the calling thread is not capturing, the capture failed
+           or the graph cannot be created.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API ffrt_graph_t ffrt_graph_end_capture(void);
+
+/**
+ * @brief Obtains the number of nodes of a graph.
+ *
+ * @param graph Indicates a graph handle.
+ * @return Returns the number of nodes.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API uint32_t ffrt_graph_get_node_count(ffrt_graph_t graph);
+
+/**
+ * @brief Replaces the task executor of a graph node for the following launches.
+ *
+ * The graph owns the executors of its nodes. The replaced executor is destroyed by the graph.
+ * The graph takes ownership of f only if this call succeeds. Otherwise the caller still owns f and
+ * must release it by calling its destroy function.
+ *
+ * @param graph Indicates a graph handle.
+ * @param index Indicates the node index, which is the submission order during capture.
+ * @param f Indicates a pointer to the new task executor.
+ * @return {@link ffrt_success} 0 - success.
+ *         {@link ffrt_error_inval} 22 - if graph or f is null or index is out of range.
+ *         {@link ffrt_error_busy} 16 - if the graph is running.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_graph_set_node_function(ffrt_graph_t graph, uint32_t index, ffrt_function_header_t* f);
+
+/**
+ * @brief Replaces a data dependency pointer in all nodes of a graph for the following launches.
+ *
+ * The dependency edges of the graph are unchanged.
+ *
+ * @param graph Indicates a graph handle.
+ * @param old_ptr Indicates the captured data dependency pointer.
+ * @param new_ptr Indicates the new data dependency pointer.
+ * @return {@link ffrt_success} 0 - success.
+ *         {@link ffrt_error_inval} 22 - if graph is null or old_ptr is not a data dependency of the graph.
+ *         {@link ffrt_error_busy} 16 - if the graph is running.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_graph_update_dependence(ffrt_graph_t graph, const void* old_ptr, const void* new_ptr);
+
+/**
+ * @brief Launches all nodes of a graph.
+ *
+ * @param graph Indicates a graph handle.
+ * @param attr Indicates a pointer to the task attribute, which overrides the QoS of all nodes.
+ *             A null pointer keeps the captured attributes.
+ * @return {@link ffrt_success} 0 - success.
+ *         {@link ffrt_error_inval} 22 - if graph is null.
+ *         {@link ffrt_error_busy} 16 - if the previous launch of the graph is not complete.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_graph_launch(ffrt_graph_t graph, const ffrt_task_attr_t* attr);
+
+/**
+ * @brief Waits until the last launch of a graph is complete.
+ *
+ * @param graph Indicates a graph handle.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API void ffrt_graph_wait(ffrt_graph_t graph);
+
+/**
+ * @brief Destroys a graph and the task executors of its nodes.
+ *
+ * A graph cannot be destroyed while a launch of it is running. Call {@link ffrt_graph_wait} first.
+ *
+ * @param graph Indicates a graph handle.
+ * @return Returns 0 if the graph is destroyed;
+           returns -1 if graph is null or the last launch of the graph is not complete,
+           in which case the graph is not destroyed.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_graph_destroy(ffrt_graph_t graph);
+#endif
@@ -38,6 +38,7 @@
 #ifndef FFRT_API_C_LOOP_H
 #define FFRT_API_C_LOOP_H
 
+#include <sys/socket.h>
 #include "queue.h"
 #include "type_def.h"
 
@@ -59,9 +60,36 @@ typedef void* ffrt_loop_t;
  */
 FFRT_C_API ffrt_loop_t ffrt_loop_create(ffrt_queue_t queue);
 
+/**
+ * @brief Creates a loop with the specified io backend.
+ *
+ * If the io_uring backend is not supported by the kernel, the loop falls back to the epoll backend.
+ * Use {@link ffrt_loop_get_backend} to obtain the backend actually in use.
+ *
+ * @param queue Indicates a queue.
+ * @param backend Indicates the preferred io backend.
+ * @return Returns a non-null loop handle if the loop is created;
+           returns a null pointer otherwise.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API ffrt_loop_t ffrt_loop_create_with_backend(ffrt_queue_t queue, ffrt_loop_backend_t backend);
+
+/**
+ * @brief Obtains the io backend of a loop.
+ *
+ * @param loop Indicates a loop handle.
+ * @return Returns the io backend in use.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API ffrt_loop_backend_t ffrt_loop_get_backend(ffrt_loop_t loop);
+
 /**
  * @brief Destroys a loop.
  *
+ * The io operations still pending on the loop complete with <b>-ECANCELED</b> before the loop is destroyed.
+ *
  * @param loop Indicates a loop handle.
  * @return returns 0 if the loop is destroyed;
            returns -1 otherwise.
@@ -106,9 +134,80 @@ FFRT_C_API void ffrt_loop_stop(ffrt_loop_t loop);
  */
 FFRT_C_API int ffrt_loop_epoll_ctl(ffrt_loop_t loop, int op, int fd, uint32_t events, void *data, ffrt_poller_cb cb);
 
+/**
+ * @brief Submit a read on ffrt loop
+ *
+ * On the io_uring backend, the reads, writes and accepts submitted during one loop iteration are
+ * passed to the kernel in one batch. On the epoll backend, the operation is performed when fd is readable,
+ * and on a file descriptor that cannot be polled, such as a regular file, it is performed by a task
+ * submitted to the queue of the loop, so the same code works on both backends.
+ *
+ * Every submitted operation completes exactly once, by executing cb. When the loop is stopped by
+ * {@link ffrt_loop_stop}, operations that have not been performed yet complete with <b>-ECANCELED</b>,
+ * and {@link ffrt_loop_run} returns only after all operations have completed. Operations submitted to a loop
+ * that is not running complete with <b>-ECANCELED</b> when it is destroyed by {@link ffrt_loop_destroy}.
+ * After cb is executed, the buffers of the operation are no longer accessed and can be freed.
+ *
+ * @param loop Indicates a loop handle.
+ * @param fd Indicates the file descriptor to read from.
+ * @param buf Indicates the buffer to read into, which must stay valid until cb is executed.
+ * @param len Indicates the size of buf, unit is byte.
+ * @param offset Indicates the file offset, or -1 to use the current file position.
+ * @param data Indicates user data used in cb.
+ * @param cb Indicates user cb which will be executed when the read is complete.
+ * @return Returns 0 if success;
+           returns -1 otherwise.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_loop_submit_read(
+    ffrt_loop_t loop, int fd, void* buf, size_t len, int64_t offset, void* data, ffrt_io_cb cb);
+
+/**
+ * @brief Submit a write on ffrt loop
+ *
+ * See {@link ffrt_loop_submit_read} for the backends and for how pending operations complete.
+ *
+ * @param loop Indicates a loop handle.
+ * @param fd Indicates the file descriptor to write to.
+ * @param buf Indicates the buffer to write from, which must stay valid until cb is executed.
+ * @param len Indicates the size of buf, unit is byte.
+ * @param offset Indicates the file offset, or -1 to use the current file position.
+ * @param data Indicates user data used in cb.
+ * @param cb Indicates user cb which will be executed when the write is complete.
+ * @return Returns 0 if success;
+           returns -1 otherwise.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_loop_submit_write(
+    ffrt_loop_t loop, int fd, const void* buf, size_t len, int64_t offset, void* data, ffrt_io_cb cb);
+
+/**
+ * @brief Submit an accept on ffrt loop
+ *
+ * See {@link ffrt_loop_submit_read} for the backends and for how pending operations complete.
+ *
+ * @param loop Indicates a loop handle.
+ * @param fd Indicates the listening socket.
+ * @param addr Indicates the peer address to fill, which can be null.
+ * @param addrlen Indicates the size of addr, which must stay valid until cb is executed.
+ * @param data Indicates user data used in cb.
+ * @param cb Indicates user cb which will be executed with the accepted file descriptor.
+ * @return Returns 0 if success;
+           returns -1 otherwise.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_loop_submit_accept(
+    ffrt_loop_t loop, int fd, struct sockaddr* addr, socklen_t* addrlen, void* data, ffrt_io_cb cb);
+
 /**
  * @brief Start a timer on ffrt loop
  *
+ * The loop keeps its timers in a hierarchical timing wheel, so starting and stopping a timer take constant time.
+ * On the io_uring backend, the next tick of the wheel is submitted as a timeout operation together with other io.
+ *
  * @param loop Indicates a loop handle.
  * @param timeout Indicates the number of milliseconds that specifies timeout.
  * @param data Indicates user data used in cb.
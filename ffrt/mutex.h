@@ -57,7 +57,7 @@ FFRT_C_API int ffrt_mutexattr_init(ffrt_mutexattr_t* attr);
  * @param attr Indicates a pointer to the mutex attribute.
  * @param type Indicates a int to the mutex type.
  * @return {@link ffrt_success} 0 - success.
- *         {@link ffrt_error_inval} 22 - if attr is null or type is not 0 or 2.
+ *         {@link ffrt_error_inval} 22 - if attr is null or type is not 0, 2 or 3.
  * @since 12
  * @version 1.0
  */
@@ -141,4 +141,19 @@ FFRT_C_API int ffrt_mutex_trylock(ffrt_mutex_t* mutex);
  * @version 1.0
  */
 FFRT_C_API int ffrt_mutex_destroy(ffrt_mutex_t* mutex);
+
+/**
+ * @brief Obtains the contention statistics of a mutex.
+ *
+ * Only the members defined by the version set in stats are written.
+ *
+ * @param mutex Indicates a pointer to the mutex.
+ * @param stats Indicates a pointer to the statistics to fill, whose version member must be set.
+ * @return {@link ffrt_success} 0 - success.
+ *         {@link ffrt_error_inval} 22 - if mutex or stats is null, mutex is not an adaptive mutex,
+ *         or the version of stats is not supported.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_mutex_get_stats(ffrt_mutex_t* mutex, ffrt_mutex_stats_t* stats);
 #endif
@@ -38,6 +38,7 @@
 #ifndef FFRT_API_C_QUEUE_H
 #define FFRT_API_C_QUEUE_H
 
+#include <stdbool.h>
 #include "type_def.h"
 
 typedef enum {
@@ -148,6 +149,36 @@ FFRT_C_API void ffrt_queue_attr_set_max_concurrency(ffrt_queue_attr_t* attr, con
  */
 FFRT_C_API int ffrt_queue_attr_get_max_concurrency(const ffrt_queue_attr_t* attr);
 
+/**
+ * @brief Enables the lock-free submission path of a serial queue.
+ *
+ * When enabled, tasks submitted without delay and without queue priority are pushed to a wait-free
+ * multi-producer single-consumer list and do not take the queue lock. Delayed tasks and tasks with
+ * a queue priority keep the locked path. The queue, and every submission on the locked path, first moves
+ * the pending lock-free tasks to the tail of the queue in push order, so non-delayed tasks without a queue
+ * priority keep one FIFO order whichever path they take: if the submission of one such task returns before
+ * the submission of another starts, the first task runs first. Delayed tasks run when their delay expires,
+ * and tasks with a queue priority are placed by their priority, as when this attribute is disabled.
+ * Tasks submitted through the lock-free path can be canceled by {@link ffrt_queue_cancel} until they start.
+ * This attribute is ignored by concurrent queues.
+ *
+ * @param attr Serial Queue Property Pointer.
+ * @param enable Indicates whether to enable the lock-free submission path.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API void ffrt_queue_attr_set_lockfree_submit(ffrt_queue_attr_t* attr, bool enable);
+
+/**
+ * @brief Get whether the lock-free submission path of a serial queue is enabled.
+ *
+ * @param attr Serial Queue Property Pointer.
+ * @return Returns whether the lock-free submission path is enabled, which is <b>false</b> by default.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API bool ffrt_queue_attr_get_lockfree_submit(const ffrt_queue_attr_t* attr);
+
 /**
  * @brief Creates a queue.
  *
@@ -215,6 +246,21 @@ FFRT_C_API void ffrt_queue_wait(ffrt_task_handle_t handle);
  */
 FFRT_C_API int ffrt_queue_cancel(ffrt_task_handle_t handle);
 
+/**
+ * @brief Obtains the runtime statistics of a queue.
+ *
+ * Time histograms are only filled while statistics are enabled by {@link ffrt_stats_enable}.
+ * Only the members defined by the version set in stats are written.
+ *
+ * @param queue Indicates a queue handle.
+ * @param stats Indicates a pointer to the statistics to fill, whose version member must be set.
+ * @return {@link ffrt_success} 0 - success.
+ *         {@link ffrt_error_inval} 22 - if queue or stats is null, or the version of stats is not supported.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_queue_get_stats(ffrt_queue_t queue, ffrt_queue_stats_t* stats);
+
 /**
  * @brief Get application main thread queue.
  *
@@ -37,6 +37,8 @@
  */
 #ifndef FFRT_API_C_TASK_H
 #define FFRT_API_C_TASK_H
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "type_def.h"
 
@@ -161,6 +163,83 @@ FFRT_C_API void ffrt_task_attr_set_stack_size(ffrt_task_attr_t* attr, uint64_t s
  */
 FFRT_C_API uint64_t ffrt_task_attr_get_stack_size(const ffrt_task_attr_t* attr);
 
+/**
+ * @brief Sets whether a task runs without its own coroutine stack.
+ *
+ * A stackless task runs to completion on the stack of the worker thread, which saves the stack
+ * allocation and context switch setup. If a stackless task blocks, for example in {@link ffrt_usleep},
+ * {@link ffrt_mutex_lock} or {@link ffrt_wait}, the worker thread blocks instead of switching to
+ * another task. The stack size set by {@link ffrt_task_attr_set_stack_size} is ignored.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @param stackless Indicates whether the task is stackless.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API void ffrt_task_attr_set_stackless(ffrt_task_attr_t* attr, bool stackless);
+
+/**
+ * @brief Obtains whether a task runs without its own coroutine stack.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @return Returns whether the task is stackless, which is <b>false</b> by default.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API bool ffrt_task_attr_get_stackless(const ffrt_task_attr_t* attr);
+
+/**
+ * @brief Sets the scheduling mode of the worker group of a QoS.
+ *
+ * The mode must be set before the first task of the QoS is submitted, for example
+ * through {@link ffrt_submit_base} or {@link ffrt_submit_h_base}.
+ *
+ * @param qos Indicates the QoS of the worker group.
+ * @param mode Indicates the scheduling mode.
+ * @return {@link ffrt_success} 0 - success.
+ *         {@link ffrt_error_inval} 22 - if qos or mode is invalid.
+ *         {@link ffrt_error_busy} 16 - if tasks have already been submitted to the QoS.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_set_sched_mode(ffrt_qos_t qos, ffrt_sched_mode_t mode);
+
+/**
+ * @brief Obtains the scheduling mode of the worker group of a QoS.
+ *
+ * @param qos Indicates the QoS of the worker group.
+ * @return Returns the scheduling mode, which is <b>ffrt_sched_mode_default</b> by default.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API ffrt_sched_mode_t ffrt_get_sched_mode(ffrt_qos_t qos);
+
+/**
+ * @brief Enables or disables the collection of time statistics.
+ *
+ * Task counters are always collected. Wait time and execution time histograms are only collected
+ * while enabled, because they need timestamps on every task.
+ *
+ * @param enable Indicates whether to collect time statistics.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API void ffrt_stats_enable(bool enable);
+
+/**
+ * @brief Obtains the runtime statistics of the worker group of a QoS.
+ *
+ * Only the members defined by the version set in stats are written.
+ *
+ * @param qos Indicates the QoS of the worker group.
+ * @param stats Indicates a pointer to the statistics to fill, whose version member must be set.
+ * @return {@link ffrt_success} 0 - success.
+ *         {@link ffrt_error_inval} 22 - if qos is invalid, stats is null or the version of stats is not supported.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_qos_get_stats(ffrt_qos_t qos, ffrt_qos_stats_t* stats);
+
 /**
  * @brief Updates the QoS of this task.
  *
@@ -229,6 +308,85 @@ FFRT_C_API void ffrt_submit_base(ffrt_function_header_t* f, const ffrt_deps_t* i
 FFRT_C_API ffrt_task_handle_t ffrt_submit_h_base(ffrt_function_header_t* f, const ffrt_deps_t* in_deps,
     const ffrt_deps_t* out_deps, const ffrt_task_attr_t* attr);
 
+/**
+ * @brief Submits a batch of tasks in one call.
+ *
+ * The dependency edges of all tasks are built in a single pass and the workers are woken up once
+ * after the whole batch has been enqueued. Dependencies between tasks of the same batch are resolved
+ * in array order, so the result is the same as calling {@link ffrt_submit_base} for each task in turn.
+ * On success the runtime takes ownership of all task executors, as {@link ffrt_submit_base} does.
+ * On failure it takes ownership of none of them: no executor is executed or destroyed, and the caller
+ * must release every non-null executor itself by calling its destroy function.
+ *
+ * @param fs Indicates a pointer to the array of task executors, which contains <b>count</b> elements.
+ *           It can be null if count is 0.
+ * @param in_deps Indicates a pointer to the array of input dependencies, one per task.
+ *                A null pointer means that no task in the batch has input dependencies.
+ * @param out_deps Indicates a pointer to the array of output dependencies, one per task.
+ *                 A null pointer means that no task in the batch has output dependencies.
+ * @param attr Indicates a pointer to the task attribute shared by all tasks in the batch.
+ * @param count Indicates the number of tasks in the batch. If it is 0, the call does nothing.
+ * @return {@link ffrt_success} 0 - if all tasks are submitted, or count is 0.
+ *         {@link ffrt_error_inval} 22 - if fs is null or any task executor is null while count is not 0.
+ *         In this case no task of the batch is submitted.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_submit_batch(ffrt_function_header_t** fs, const ffrt_deps_t* in_deps,
+    const ffrt_deps_t* out_deps, const ffrt_task_attr_t* attr, uint32_t count);
+
+/**
+ * @brief Runs a loop over [begin, end) in parallel and waits until all iterations are complete.
+ *
+ * How the range is split depends on the scheduling mode of the QoS, see {@link ffrt_set_sched_mode}.
+ * In <b>ffrt_sched_mode_work_stealing</b>, the range is split lazily and recursively: a worker keeps
+ * halving its range only while other workers of the QoS are idle and steal from it.
+ * In <b>ffrt_sched_mode_shared_queue</b>, the range is split up front into chunks of equal size, about
+ * four per worker of the QoS, which are submitted to the shared queue and taken by workers in order.
+ * In both modes a chunk never has fewer than <b>grain</b> iterations, except the last one.
+ * The calling thread also processes chunks while it waits.
+ *
+ * @param begin Indicates the first iteration.
+ * @param end Indicates the iteration after the last one.
+ * @param grain Indicates the minimum number of iterations per chunk. <b>0</b> lets the runtime choose.
+ * @param fn Indicates the callback that processes one chunk.
+ * @param ctx Indicates user data used in fn.
+ * @param qos Indicates the QoS of the tasks that run the chunks.
+ * @return {@link ffrt_success} 0 - success.
+ *         {@link ffrt_error_inval} 22 - if fn is null or begin is greater than end.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_parallel_for(uint64_t begin, uint64_t end, uint64_t grain, ffrt_parallel_for_cb fn, void* ctx,
+    ffrt_qos_t qos);
+
+/**
+ * @brief Runs a reduction over [begin, end) in parallel and waits until it is complete.
+ *
+ * The range is split in the same way as {@link ffrt_parallel_for}. Every chunk accumulates into its own
+ * partial result of <b>size</b> bytes, which starts as a copy of <b>identity</b>. Partial results are
+ * merged with <b>combine</b> in iteration order, so combine only needs to be associative.
+ *
+ * @param begin Indicates the first iteration.
+ * @param end Indicates the iteration after the last one.
+ * @param grain Indicates the minimum number of iterations per chunk. <b>0</b> lets the runtime choose.
+ * @param result Indicates a pointer to the final result, which is overwritten.
+ * @param identity Indicates a pointer to the identity value of the reduction.
+ * @param size Indicates the size of the result and identity, unit is byte.
+ * @param fn Indicates the callback that accumulates one chunk.
+ * @param combine Indicates the callback that merges two partial results.
+ * @param ctx Indicates user data used in fn and combine.
+ * @param qos Indicates the QoS of the tasks that run the chunks.
+ * @return {@link ffrt_success} 0 - success.
+ *         {@link ffrt_error_inval} 22 - if a pointer argument is null, size is 0 or begin is greater than end.
+ *         {@link ffrt_error_nomem} 12 - if the partial results cannot be allocated.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_parallel_reduce(uint64_t begin, uint64_t end, uint64_t grain, void* result,
+    const void* identity, size_t size, ffrt_parallel_reduce_cb fn, ffrt_parallel_combine_cb combine, void* ctx,
+    ffrt_qos_t qos);
+
 /**
  * @brief increase reference count of task handle.
  *
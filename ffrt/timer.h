@@ -44,6 +44,8 @@
 /**
  * @brief Start a timer on ffrt worker
  *
+ * Timers are kept in a hierarchical timing wheel, so starting and stopping a timer take constant time.
+ *
  * @param qos Indicates qos of the worker that runs timer.
  * @param timeout Indicates the number of milliseconds that specifies timeout.
  * @param data Indicates user data used in cb.
@@ -66,4 +68,19 @@ FFRT_C_API ffrt_timer_t ffrt_timer_start(ffrt_qos_t qos, uint64_t timeout, void*
  * @version 1.0
  */
 FFRT_C_API int ffrt_timer_stop(ffrt_qos_t qos, ffrt_timer_t handle);
+
+/**
+ * @brief Set the tick granularity of the timers on ffrt worker
+ *
+ * Timers that expire within the same tick are fired by one wakeup. A coarser tick saves wakeups
+ * at the cost of firing a timer up to one tick late.
+ *
+ * @param qos Indicates qos of the worker that runs timer.
+ * @param granularity Indicates the number of milliseconds of one tick, which is 1 by default.
+ * @return Returns 0 if success;
+           returns -1 otherwise.
+ * @since 14
+ * @version 1.0
+ */
+FFRT_C_API int ffrt_timer_set_granularity(ffrt_qos_t qos, uint64_t granularity);
 #endif
\ No newline at end of file
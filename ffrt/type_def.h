@@ -80,6 +80,20 @@ typedef enum {
 } ffrt_qos_default_t;
 typedef int ffrt_qos_t;
 
+/**
+ * @brief Enumerates the scheduling modes of a QoS worker group.
+ *
+ * @since 14
+ */
+typedef enum {
+    /** All workers of the QoS share one task queue. */
+    ffrt_sched_mode_shared_queue = 0,
+    /** Each worker owns a lock-free deque and steals from other workers only when idle. */
+    ffrt_sched_mode_work_stealing,
+    /** Default scheduling mode. */
+    ffrt_sched_mode_default = ffrt_sched_mode_shared_queue
+} ffrt_sched_mode_t;
+
 typedef void(*ffrt_function_t)(void*);
 
 /**
@@ -187,7 +201,9 @@ typedef struct {
  * @brief ffrt mutex type enum
  *
  * Describes the mutex type, ffrt_mutex_normal is normal mutex;
- * ffrt_mutex_recursive is recursive mutex, ffrt_mutex_default is normal mutex.
+ * ffrt_mutex_recursive is recursive mutex, ffrt_mutex_default is normal mutex;
+ * ffrt_mutex_adaptive is normal mutex that spins while the owner is running before parking the task,
+ * and records contention statistics.
  *
  * @since 12
  */
@@ -196,6 +212,12 @@ typedef enum {
     ffrt_mutex_normal = 0,
     /** ffrt recursive mutex type */
     ffrt_mutex_recursive = 2,
+    /**
+     * ffrt adaptive mutex type
+     *
+     * @since 14
+     */
+    ffrt_mutex_adaptive = 3,
     /** ffrt default mutex type */
     ffrt_mutex_default = ffrt_mutex_normal
 } ffrt_mutex_type;
@@ -204,10 +226,51 @@ typedef struct {
     uint32_t storage[(ffrt_mutex_storage_size + sizeof(uint32_t) - 1) / sizeof(uint32_t)];
 } ffrt_mutex_t;
 
+/**
+ * @brief Indicates version of {@link ffrt_mutex_stats_t}
+ *
+ * @since 14
+ */
+#define FFRT_MUTEX_STATS_VERSION 1
+
+/**
+ * @brief Defines the contention statistics of an adaptive mutex.
+ *
+ * @since 14
+ */
+typedef struct {
+    /** Version of the struct, which is set by the caller, for example to FFRT_MUTEX_STATS_VERSION. */
+    uint32_t version;
+    /** Number of successful locks. */
+    uint64_t acquisitions;
+    /** Number of locks that found the mutex held. */
+    uint64_t contentions;
+    /** Number of contended locks that parked the task after spinning. */
+    uint64_t parks;
+    /** Total time spent waiting for the mutex, in nanoseconds. */
+    uint64_t total_wait_ns;
+    /** Longest time spent waiting for the mutex, in nanoseconds. */
+    uint64_t max_wait_ns;
+    /** ID of the task holding the mutex, or 0 if the mutex is not held. */
+    uint64_t holder;
+} ffrt_mutex_stats_t;
+
 typedef struct {
     uint32_t storage[(ffrt_cond_storage_size + sizeof(uint32_t) - 1) / sizeof(uint32_t)];
 } ffrt_cond_t;
 
+/**
+ * @brief Enumerates the io backends of a loop.
+ *
+ * @since 14
+ */
+typedef enum {
+    /** Readiness-driven backend based on epoll. */
+    ffrt_loop_backend_epoll = 0,
+    /** Completion-driven backend based on io_uring. */
+    ffrt_loop_backend_io_uring,
+} ffrt_loop_backend_t;
+
 /**
  * @brief poller callback.
  *
@@ -215,6 +278,16 @@ typedef struct {
  */
 typedef void (*ffrt_poller_cb)(void* data, uint32_t event);
 
+/**
+ * @brief io completion callback.
+ *
+ * result is the number of bytes transferred or the accepted file descriptor on success,
+ * or a negative error number on failure.
+ *
+ * @since 14
+ */
+typedef void (*ffrt_io_cb)(void* data, int64_t result);
+
 /**
  * @brief timer callback.
  *
@@ -229,6 +302,109 @@ typedef void (*ffrt_timer_cb)(void* data);
  */
 typedef int ffrt_timer_t;
 
+/**
+ * @brief parallel for callback, which processes the iterations in [begin, end).
+ *
+ * @since 14
+ */
+typedef void (*ffrt_parallel_for_cb)(uint64_t begin, uint64_t end, void* ctx);
+
+/**
+ * @brief parallel reduce callback, which accumulates the iterations in [begin, end) into partial.
+ *
+ * @since 14
+ */
+typedef void (*ffrt_parallel_reduce_cb)(uint64_t begin, uint64_t end, void* partial, void* ctx);
+
+/**
+ * @brief parallel reduce combine callback, which merges the partial result src into dst.
+ *
+ * @since 14
+ */
+typedef void (*ffrt_parallel_combine_cb)(void* dst, const void* src, void* ctx);
+
+/**
+ * @brief Defines a time histogram.
+ *
+ * Bucket 0 counts samples under 1 microsecond, bucket i counts samples in [2^(i-1), 2^i) microseconds
+ * and the last bucket also counts all longer samples.
+ *
+ * @since 14
+ */
+typedef struct {
+    /** Number of samples in each bucket. */
+    uint64_t buckets[32];
+} ffrt_histogram_t;
+
+/**
+ * @brief Indicates version of {@link ffrt_queue_stats_t}
+ *
+ * @since 14
+ */
+#define FFRT_QUEUE_STATS_VERSION 1
+
+/**
+ * @brief Defines the runtime statistics of a queue.
+ *
+ * All counters are cumulative since the queue is created.
+ *
+ * @since 14
+ */
+typedef struct {
+    /** Version of the struct, which is set by the caller, for example to FFRT_QUEUE_STATS_VERSION. */
+    uint32_t version;
+    /** Number of submitted tasks. */
+    uint64_t submitted;
+    /** Number of completed tasks. */
+    uint64_t completed;
+    /** Number of cancelled tasks. */
+    uint64_t cancelled;
+    /** Number of tasks waiting in the queue when the statistics are obtained. */
+    uint64_t depth;
+    /** Time from submission to start of execution. */
+    ffrt_histogram_t wait_time;
+    /** Time from start to end of execution. */
+    ffrt_histogram_t exec_time;
+} ffrt_queue_stats_t;
+
+/**
+ * @brief Indicates version of {@link ffrt_qos_stats_t}
+ *
+ * @since 14
+ */
+#define FFRT_QOS_STATS_VERSION 1
+
+/**
+ * @brief Defines the runtime statistics of the worker group of a QoS.
+ *
+ * All counters are cumulative since the process starts. Worker utilization over an interval is
+ * the difference of busy_time_us divided by the difference of alive_time_us of two snapshots.
+ *
+ * @since 14
+ */
+typedef struct {
+    /** Version of the struct, which is set by the caller, for example to FFRT_QOS_STATS_VERSION. */
+    uint32_t version;
+    /** Number of submitted tasks. */
+    uint64_t submitted;
+    /** Number of completed tasks. */
+    uint64_t completed;
+    /** Number of ready tasks waiting for a worker when the statistics are obtained. */
+    uint64_t depth;
+    /** Number of tasks stolen by idle workers. */
+    uint64_t steals;
+    /** Number of workers when the statistics are obtained. */
+    uint32_t workers;
+    /** Total time workers spent executing tasks, in microseconds. */
+    uint64_t busy_time_us;
+    /** Total lifetime of workers, in microseconds. */
+    uint64_t alive_time_us;
+    /** Time from ready to start of execution. */
+    ffrt_histogram_t wait_time;
+    /** Time from start to end of execution. */
+    ffrt_histogram_t exec_time;
+} ffrt_qos_stats_t;
+
 
 #ifdef __cplusplus
 namespace ffrt {
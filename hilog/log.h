@@ -61,6 +61,7 @@
  */
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -162,6 +163,162 @@ int OH_LOG_Print(LogType type, LogLevel level, unsigned int domain, const char *
  */
 bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
 
+/**
+ * @brief Obtains the generation counter of the log configuration.
+ *
+ * The counter starts at 1 and is incremented whenever the log configuration of the process changes, for example
+ * when a log level is changed, so that cached results of {@link OH_LOG_IsLoggable} can be revalidated.
+ *
+ * @return Returns a pointer to the counter, which stays valid until the process exits.
+ * @since 14
+ */
+const unsigned int *OH_LOG_GetConfigGeneration(void);
+
+/**
+ * @brief Defines the cached result of {@link OH_LOG_IsLoggable} for one call site.
+ *
+ * Initialize it with zeros, for example as a static variable.
+ *
+ * @since 14
+ */
+typedef struct {
+    /** Generation of the cached result shifted left by one bit, and the cached result in the lowest bit. */
+    unsigned int state;
+} LogSiteCache;
+
+/**
+ * @brief Checks whether logs can be output, using the result cached in a call site cache.
+ *
+ * {@link OH_LOG_IsLoggable} is only called when the cache is empty or the log configuration has changed since
+ * the result was cached. Otherwise the check costs three atomic loads: the cached pointer to the generation
+ * counter, the counter itself and the state of the cache.
+ * The cache is not keyed by domain, tag or level, so all calls with the same cache must pass the same values.
+ *
+ * @param cache Indicates the cache of the call site.
+ * @param domain Indicates the service domain of logs.
+ * @param tag Indicates the log tag.
+ * @param level Indicates the log level.
+ * @return Returns <b>true</b> if the specified logs can be output; returns <b>false</b> otherwise.
+ * @since 14
+ */
+static inline bool OH_LOG_IsLoggableCached(LogSiteCache *cache, unsigned int domain, const char *tag,
+    LogLevel level)
+{
+    static const unsigned int *generation = NULL;
+    const unsigned int *gen = __atomic_load_n(&generation, __ATOMIC_ACQUIRE);
+    if (gen == NULL) {
+        gen = OH_LOG_GetConfigGeneration();
+        __atomic_store_n(&generation, gen, __ATOMIC_RELEASE);
+    }
+    unsigned int current = __atomic_load_n(gen, __ATOMIC_ACQUIRE);
+    unsigned int state = __atomic_load_n(&cache->state, __ATOMIC_RELAXED);
+    if ((state >> 1) == current) {
+        return (state & 1U) != 0;
+    }
+    bool loggable = OH_LOG_IsLoggable(domain, tag, level);
+    __atomic_store_n(&cache->state, (current << 1) | (loggable ? 1U : 0U), __ATOMIC_RELAXED);
+    return loggable;
+}
+
+/**
+ * @brief Records logs without formatting them on the calling thread.
+ *
+ * The format string pointer and the raw bytes of the parameters are written to a lock-free ring buffer of the
+ * calling thread, and a consumer thread formats and outputs the log later with the time of this call.
+ * String parameters are copied, so they need not outlive the call, but tag and fmt must be string literals
+ * or otherwise stay valid until the process exits. If the ring buffer is full, the log is dropped.
+ * When a thread that has recorded deferred logs calls {@link OH_LOG_Print}, for example through OH_LOG_ERROR,
+ * the logs in its ring buffer are output first, so that the logs of one thread stay in order.
+ * When a thread exits, the logs left in its ring buffer are still output by the consumer thread, and the ring
+ * buffer is released afterwards. Logs not output yet are lost if the process terminates abnormally, so logs
+ * written just before a crash should use {@link OH_LOG_Print}, as the OH_LOG_ERROR and OH_LOG_FATAL macros do.
+ *
+ * @param type Indicates the log type. The type for third-party applications is defined by {@link LOG_APP}.
+ * @param level Indicates the log level, which can be <b>LOG_DEBUG</b>, <b>LOG_INFO</b>, <b>LOG_WARN</b>,
+ * <b>LOG_ERROR</b>, and <b>LOG_FATAL</b>.
+ * @param domain Indicates the service domain of logs. Its value is a hexadecimal integer ranging from 0x0 to 0xFFFF.
+ * @param tag Indicates the log tag, which is a string used to identify the class, file, or service behavior.
+ * @param fmt Indicates the format string, which is the same as that of {@link OH_LOG_Print}.
+ * @param ... Indicates a list of parameters. The number and type of parameters must map onto the format specifiers
+ * in the format string.
+ * @return Returns <b>0</b> if the log is recorded; returns a value smaller than <b>0</b> if it is dropped.
+ * @since 14
+ */
+int OH_LOG_PrintDeferred(LogType type, LogLevel level, unsigned int domain, const char *tag, const char *fmt, ...)
+    __attribute__((__format__(os_log, 5, 6)));
+
+/**
+ * @brief Sets the size of the ring buffer used by {@link OH_LOG_PrintDeferred} on each thread.
+ *
+ * The size applies to ring buffers created after this call, that is, to threads that have not recorded a deferred
+ * log yet.
+ *
+ * @param size Indicates the size of the ring buffer, in bytes.
+ * @since 14
+ */
+void OH_LOG_SetDeferredBufferSize(size_t size);
+
+/**
+ * @brief Formats and outputs all logs recorded by {@link OH_LOG_PrintDeferred} so far, and waits until it is done.
+ *
+ * @return Returns the number of logs dropped because a ring buffer was full since the last call.
+ * @since 14
+ */
+unsigned int OH_LOG_FlushDeferred(void);
+
+/**
+ * @brief Defines the function used by the OH_LOG_DEBUG, OH_LOG_INFO and OH_LOG_WARN macros.
+ *
+ * Define <b>LOG_DEFERRED</b> before including this file to route these macros to {@link OH_LOG_PrintDeferred}.
+ * OH_LOG_ERROR and OH_LOG_FATAL always use {@link OH_LOG_Print}, so that they are output before a crash.
+ *
+ * @since 14
+ */
+#ifdef LOG_DEFERRED
+#define OH_LOG_PRINT_FUNC OH_LOG_PrintDeferred
+#else
+#define OH_LOG_PRINT_FUNC OH_LOG_Print
+#endif
+
+/**
+ * @brief Defines the minimum log level that is compiled in.
+ *
+ * The OH_LOG_DEBUG to OH_LOG_FATAL macros below this level are removed at compile time, and their parameters are
+ * not evaluated. Define it before including this file, for example as <b>LOG_INFO</b> in release builds.
+ *
+ * @since 14
+ */
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL LOG_DEBUG
+#endif
+
+/**
+ * @brief Outputs logs of the specified level. This is a function-like macro used by OH_LOG_DEBUG to OH_LOG_FATAL.
+ *
+ * Define <b>LOG_SITE_CACHE</b> before including this file to cache the result of {@link OH_LOG_IsLoggable} in
+ * each call site, see {@link OH_LOG_IsLoggableCached}. Each call site then defines a static variable in a GNU
+ * statement expression, so the macros cannot be used in C inline functions that are not static, and the
+ * application requires API version 14. LOG_DOMAIN and LOG_TAG must then expand to constants, because the
+ * result cached for a call site is reused whatever values they have on later calls.
+ *
+ * @param func Indicates the function that outputs the log, {@link OH_LOG_Print} or {@link OH_LOG_PrintDeferred}.
+ * @param type Indicates the log type. The type for third-party applications is defined by {@link LOG_APP}.
+ * @param level Indicates the log level.
+ * @param ... Indicates the format string and the list of parameters.
+ * @since 14
+ */
+#ifdef LOG_SITE_CACHE
+#define OH_LOG_LEVEL_PRINT(func, type, level, ...)                                                               \
+    ((level) < LOG_MIN_LEVEL ? (void)0 : __extension__({                                                         \
+        static LogSiteCache hilogSiteCache = { 0 };                                                              \
+        OH_LOG_IsLoggableCached(&hilogSiteCache, LOG_DOMAIN, LOG_TAG, (level)) ?                                 \
+            (void)func((type), (level), LOG_DOMAIN, LOG_TAG, __VA_ARGS__) : (void)0;                             \
+    }))
+#else
+#define OH_LOG_LEVEL_PRINT(func, type, level, ...)                                                               \
+    ((level) < LOG_MIN_LEVEL ? (void)0 : (void)func((type), (level), LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#endif
+
 /**
  * @brief Outputs debug logs. This is a function-like macro.
  *
@@ -177,7 +334,7 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_DEBUG(type, ...) ((void)OH_LOG_Print((type), LOG_DEBUG, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_DEBUG(type, ...) OH_LOG_LEVEL_PRINT(OH_LOG_PRINT_FUNC, (type), LOG_DEBUG, __VA_ARGS__)
 
 /**
  * @brief Outputs informational logs. This is a function-like macro.
@@ -194,7 +351,7 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_INFO(type, ...) ((void)OH_LOG_Print((type), LOG_INFO, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_INFO(type, ...) OH_LOG_LEVEL_PRINT(OH_LOG_PRINT_FUNC, (type), LOG_INFO, __VA_ARGS__)
 
 /**
  * @brief Outputs warning logs. This is a function-like macro.
@@ -211,7 +368,7 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_WARN(type, ...) ((void)OH_LOG_Print((type), LOG_WARN, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_WARN(type, ...) OH_LOG_LEVEL_PRINT(OH_LOG_PRINT_FUNC, (type), LOG_WARN, __VA_ARGS__)
 
 /**
  * @brief Outputs error logs. This is a function-like macro.
@@ -228,7 +385,7 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_ERROR(type, ...) ((void)OH_LOG_Print((type), LOG_ERROR, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_ERROR(type, ...) OH_LOG_LEVEL_PRINT(OH_LOG_Print, (type), LOG_ERROR, __VA_ARGS__)
 
 /**
  * @brief Outputs fatal logs. This is a function-like macro.
@@ -245,7 +402,7 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_FATAL(type, ...) ((void)OH_LOG_Print((type), LOG_FATAL, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_FATAL(type, ...) OH_LOG_LEVEL_PRINT(OH_LOG_Print, (type), LOG_FATAL, __VA_ARGS__)
 
 /**
  * @brief Defines the function pointer type for the user-defined log processing function.